@@ -4,6 +4,7 @@
  */
 
 #include "bme280.h"
+#include "sdkconfig.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -14,19 +15,51 @@ static const char *TAG = "BME280";
 static bme280_calib_data_t g_calib_data;
 static bool g_calib_loaded = false;
 
+#if CONFIG_WEATHERSTATION_STATIC_ALLOC
+// Statischer Puffer für I2C Command Links (Lesezugriff = 2 Transaktionen)
+static uint8_t s_i2c_cmd_buffer[I2C_LINK_RECOMMENDED_SIZE(2)];
+#endif
+
+/**
+ * @brief I2C Command Link erstellen (statisch oder Heap)
+ */
+static i2c_cmd_handle_t bme280_cmd_link_create(void)
+{
+#if CONFIG_WEATHERSTATION_STATIC_ALLOC
+    return i2c_cmd_link_create_static(s_i2c_cmd_buffer, sizeof(s_i2c_cmd_buffer));
+#else
+    return i2c_cmd_link_create();
+#endif
+}
+
+/**
+ * @brief I2C Command Link freigeben
+ */
+static void bme280_cmd_link_delete(i2c_cmd_handle_t cmd)
+{
+#if CONFIG_WEATHERSTATION_STATIC_ALLOC
+    i2c_cmd_link_delete_static(cmd);
+#else
+    i2c_cmd_link_delete(cmd);
+#endif
+}
+
 /**
  * @brief I2C Schreibfunktion
  */
 static esp_err_t bme280_i2c_write(uint8_t reg_addr, uint8_t *data, size_t len)
 {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    i2c_cmd_handle_t cmd = bme280_cmd_link_create();
+    if (cmd == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
     i2c_master_start(cmd);
     i2c_master_write_byte(cmd, (BME280_ADDR << 1) | I2C_MASTER_WRITE, true);
     i2c_master_write_byte(cmd, reg_addr, true);
     i2c_master_write(cmd, data, len, true);
     i2c_master_stop(cmd);
     esp_err_t ret = i2c_master_cmd_begin(BME280_I2C_PORT, cmd, BME280_I2C_TIMEOUT / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
+    bme280_cmd_link_delete(cmd);
     return ret;
 }
 
@@ -35,7 +68,10 @@ static esp_err_t bme280_i2c_write(uint8_t reg_addr, uint8_t *data, size_t len)
  */
 static esp_err_t bme280_i2c_read(uint8_t reg_addr, uint8_t *data, size_t len)
 {
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+    i2c_cmd_handle_t cmd = bme280_cmd_link_create();
+    if (cmd == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
     i2c_master_start(cmd);
     i2c_master_write_byte(cmd, (BME280_ADDR << 1) | I2C_MASTER_WRITE, true);
     i2c_master_write_byte(cmd, reg_addr, true);
@@ -47,7 +83,7 @@ static esp_err_t bme280_i2c_read(uint8_t reg_addr, uint8_t *data, size_t len)
     i2c_master_read_byte(cmd, data + len - 1, I2C_MASTER_NACK);
     i2c_master_stop(cmd);
     esp_err_t ret = i2c_master_cmd_begin(BME280_I2C_PORT, cmd, BME280_I2C_TIMEOUT / portTICK_PERIOD_MS);
-    i2c_cmd_link_delete(cmd);
+    bme280_cmd_link_delete(cmd);
     return ret;
 }
 
@@ -286,6 +322,9 @@ esp_err_t bme280_read_data(bme280_data_t *data)
     data->temperature = T / 100.0f;
     data->pressure = P / 256.0f;  // Pa
     data->humidity = H / 1024.0f; // % (bereits korrekt kompensiert)
+    data->temperature_centi = T;
+    data->pressure_q8 = P;
+    data->humidity_q10 = H;
     
     return ESP_OK;
 }
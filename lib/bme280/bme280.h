@@ -67,6 +67,11 @@ typedef struct {
     float temperature;    // °C
     float pressure;       // Pa
     float humidity;       // %
+    
+    // Kompensierte Festkommawerte (ohne Float-Rundung, z.B. für derived_metrics)
+    int32_t  temperature_centi;  // 0.01 °C
+    uint32_t pressure_q8;        // Pa in Q24.8 (1/256 Pa)
+    uint32_t humidity_q10;       // % in Q22.10 (1/1024 %)
 } bme280_data_t;
 
 /**
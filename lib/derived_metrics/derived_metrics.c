@@ -0,0 +1,143 @@
+/**
+ * Abgeleitete Wetterwerte Implementation
+ * ESP32-C6 WeatherstationLight Project
+ *
+ * Alle Formeln werden im log2-Bereich ausgewertet: log2 und 2^x kommen aus
+ * je einer Tabelle mit linearer Interpolation (derived_metrics_tables.h),
+ * Potenzen und Exponentialfunktionen werden so zu Multiplikationen.
+ */
+
+#include "derived_metrics.h"
+#include "derived_metrics_tables.h"
+
+#define DM_ONE          ((int32_t)1 << DM_LOG2_FRAC)   // 1.0 in Q8.24
+#define DM_INDEX_SHIFT  (31 - DM_TABLE_BITS)           // Tabellenindex aus normierter Mantisse
+
+/**
+ * @brief Multiplikation zweier Q8.24 Werte
+ */
+static int32_t dm_mul(int32_t a, int32_t b)
+{
+    return (int32_t)(((int64_t)a * b) >> DM_LOG2_FRAC);
+}
+
+/**
+ * @brief log2 eines Festkommawerts
+ * @param x Wert mit frac Nachkommabits, 0 wird auf die kleinste Einheit 1 begrenzt
+ * @param frac Anzahl Nachkommabits von x
+ * @return log2(x / 2^frac) in Q8.24
+ */
+static int32_t dm_log2(uint32_t x, int frac)
+{
+    // __builtin_clz(0) ist undefiniert (z.B. Luftdruck 0 bei ungültiger Kalibrierung)
+    if (x == 0) {
+        x = 1;
+    }
+
+    // Mantisse auf [1, 2) normieren: Bit 31 ist die führende Eins
+    int msb = 31 - __builtin_clz(x);
+    uint32_t m = x << (31 - msb);
+
+    uint32_t idx = (m >> DM_INDEX_SHIFT) & ((1u << DM_TABLE_BITS) - 1);
+    uint32_t rem = m & ((1u << DM_INDEX_SHIFT) - 1);
+    int64_t diff = (int64_t)dm_log2_table[idx + 1] - dm_log2_table[idx];
+    int32_t frac_part = (int32_t)(dm_log2_table[idx] + ((diff * rem) >> DM_INDEX_SHIFT));
+
+    return (msb - frac) * DM_ONE + frac_part;
+}
+
+/**
+ * @brief 2^y als Festkommawert
+ * @param y Exponent in Q8.24
+ * @param frac Gewünschte Nachkommabits des Ergebnisses
+ * @return 2^y * 2^frac, bei Überlauf UINT32_MAX
+ */
+static uint32_t dm_exp2(int32_t y, int frac)
+{
+    int32_t k = y >> DM_LOG2_FRAC;                       // ganzzahliger Anteil (abgerundet)
+    uint32_t f = (uint32_t)y & (DM_ONE - 1);             // Nachkommaanteil in [0, 1)
+
+    const int rem_bits = DM_LOG2_FRAC - DM_TABLE_BITS;
+    uint32_t idx = f >> rem_bits;
+    uint32_t rem = f & ((1u << rem_bits) - 1);
+    int64_t diff = (int64_t)dm_exp2_table[idx + 1] - dm_exp2_table[idx];
+    uint32_t m = dm_exp2_table[idx] + (uint32_t)((diff * rem) >> rem_bits);   // Q30 in [1, 2)
+
+    int32_t shift = k + frac - DM_EXP2_FRAC;
+    if (shift >= 0) {
+        if (shift > __builtin_clz(m)) {
+            return UINT32_MAX;
+        }
+        return m << shift;
+    }
+    if (shift < -31) {
+        return 0;
+    }
+    return (m + (1u << (-shift - 1))) >> -shift;
+}
+
+/**
+ * @brief Magnus Exponent a*T/(b+T) in Q8.24 (natürlicher Logarithmus)
+ */
+static int32_t dm_magnus_exponent(int32_t temperature_centi)
+{
+    return (int32_t)(((int64_t)DM_MAGNUS_A * temperature_centi) / (DM_MAGNUS_B_CENTI + temperature_centi));
+}
+
+/**
+ * @brief log2 der relativen Feuchte als Anteil (RH / 100 %) in Q8.24
+ */
+static int32_t dm_log2_humidity(uint32_t humidity_q10)
+{
+    return dm_log2(humidity_q10, 10) - DM_LOG2_100;
+}
+
+int32_t derived_dew_point(int32_t temperature_centi, uint32_t humidity_q10)
+{
+    // gamma = ln(RH/100) + a*T/(b+T)
+    int32_t gamma = dm_mul(dm_log2_humidity(humidity_q10), DM_LN2) + dm_magnus_exponent(temperature_centi);
+
+    // Td = b * gamma / (a - gamma)
+    return (int32_t)(((int64_t)DM_MAGNUS_B_CENTI * gamma) / (DM_MAGNUS_A - gamma));
+}
+
+uint32_t derived_absolute_humidity(int32_t temperature_centi, uint32_t humidity_q10)
+{
+    // AF = 216.7 * 6.112 * RH/100 * exp(a*T/(b+T)) / T[K], in mg/m³ im log2-Bereich
+    int32_t y = DM_ABS_HUM_LOG2
+              + dm_log2_humidity(humidity_q10)
+              + dm_mul(dm_magnus_exponent(temperature_centi), DM_LOG2E)
+              - dm_log2((uint32_t)(temperature_centi + 27315), 0);
+
+    return dm_exp2(y, 0);
+}
+
+int32_t derived_altitude(uint32_t pressure_q8, uint32_t reference_q8)
+{
+    // h = 44330.77 m * (1 - (p / p0)^(1 / 5.25588))
+    int32_t y = dm_mul(dm_log2(pressure_q8, 8) - dm_log2(reference_q8, 8), DM_BARO_EXP);
+    int32_t ratio = (int32_t)dm_exp2(y, DM_LOG2_FRAC);
+
+    return (int32_t)(((int64_t)DM_BARO_HEIGHT_CM * (DM_ONE - ratio)) >> DM_LOG2_FRAC);
+}
+
+uint32_t derived_sea_level_pressure(uint32_t pressure_q8, int32_t altitude_cm)
+{
+    // p0 = p / (1 - h / 44330.77 m)^5.25588
+    int64_t base = DM_ONE - ((int64_t)altitude_cm * DM_ONE / DM_BARO_HEIGHT_CM);
+    if (base <= 0) {
+        return 0;
+    }
+
+    int32_t y = dm_log2(pressure_q8, 8) - dm_mul(dm_log2((uint32_t)base, DM_LOG2_FRAC), DM_BARO_EXP_INV);
+    return dm_exp2(y, 8);
+}
+
+void derived_metrics_compute(int32_t temperature_centi, uint32_t pressure_q8, uint32_t humidity_q10,
+                             int32_t station_altitude_cm, derived_metrics_t *out)
+{
+    out->dew_point = derived_dew_point(temperature_centi, humidity_q10);
+    out->absolute_humidity = derived_absolute_humidity(temperature_centi, humidity_q10);
+    out->altitude = derived_altitude(pressure_q8, DERIVED_REFERENCE_PRESSURE_Q8);
+    out->sea_level_pressure_q8 = derived_sea_level_pressure(pressure_q8, station_altitude_cm);
+}
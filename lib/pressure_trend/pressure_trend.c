@@ -0,0 +1,210 @@
+/**
+ * Luftdruck-Tendenz Implementation
+ * ESP32-C6 WeatherstationLight Project
+ */
+
+#include <stddef.h>
+#include "pressure_trend.h"
+
+// Umrechnung der Steigung von Pa/s (Q24.8) in 0.01 Pa/h: 3600 * 100 / 256 = 5625 / 4
+#define SLOPE_SCALE_NUM 5625
+#define SLOPE_SCALE_DEN 4
+
+/**
+ * @brief Verschiebt den Zeitbezug der Summen auf new_base_s
+ *
+ * Hält die relativen Zeiten klein, sodass die Summen im int64 Bereich bleiben.
+ */
+static void pressure_trend_rebase(pressure_trend_t *trend, uint32_t new_base_s)
+{
+    int64_t c = (int64_t)(uint32_t)(new_base_s - trend->base_s);
+    int64_t n = trend->count;
+
+    // sum((t-c)^2) = sum(t^2) - 2c*sum(t) + n*c^2, sum((t-c)*p) = sum(t*p) - c*sum(p)
+    trend->sum_tt += -2 * c * trend->sum_t + n * c * c;
+    trend->sum_tp -= c * trend->sum_p;
+    trend->sum_t -= n * c;
+    trend->base_s = new_base_s;
+}
+
+/**
+ * @brief Entfernt den ältesten Stützpunkt aus den Summen
+ */
+static void pressure_trend_evict(pressure_trend_t *trend)
+{
+    const pressure_trend_point_t *oldest = &trend->points[trend->head];
+    int64_t t = (int64_t)(uint32_t)(oldest->time_s - trend->base_s);
+    int64_t p = oldest->pressure_q8;
+
+    trend->sum_t -= t;
+    trend->sum_p -= p;
+    trend->sum_tt -= t * t;
+    trend->sum_tp -= t * p;
+
+    trend->head = (trend->head + 1) % PRESSURE_TREND_CAPACITY;
+    trend->count--;
+
+    if (trend->count > 0) {
+        pressure_trend_rebase(trend, trend->points[trend->head].time_s);
+    }
+}
+
+/**
+ * @brief Fügt einen Stützpunkt hinzu und entfernt veraltete Stützpunkte
+ */
+static void pressure_trend_push(pressure_trend_t *trend, uint32_t time_s, uint32_t pressure_q8)
+{
+    while (trend->count > 0 &&
+           (trend->count == PRESSURE_TREND_CAPACITY ||
+            time_s - trend->points[trend->head].time_s > trend->config.window_s)) {
+        pressure_trend_evict(trend);
+    }
+
+    if (trend->count == 0) {
+        trend->base_s = time_s;
+        trend->sum_t = trend->sum_p = trend->sum_tt = trend->sum_tp = 0;
+    }
+
+    uint16_t tail = (trend->head + trend->count) % PRESSURE_TREND_CAPACITY;
+    trend->points[tail].time_s = time_s;
+    trend->points[tail].pressure_q8 = pressure_q8;
+    trend->count++;
+
+    int64_t t = (int64_t)(uint32_t)(time_s - trend->base_s);
+    int64_t p = pressure_q8;
+    trend->sum_t += t;
+    trend->sum_p += p;
+    trend->sum_tt += t * t;
+    trend->sum_tp += t * p;
+}
+
+/**
+ * @brief Schliesst den offenen Zeitschlitz ab und übernimmt seinen Mittelwert
+ */
+static void pressure_trend_close_slot(pressure_trend_t *trend)
+{
+    uint32_t n = trend->slot_count;
+    uint32_t time_s = trend->slot_start_s + (uint32_t)(trend->slot_sum_dt / n);
+    uint32_t pressure_q8 = (uint32_t)((trend->slot_sum_p + n / 2) / n);
+
+    pressure_trend_push(trend, time_s, pressure_q8);
+    trend->slot_count = 0;
+    trend->slot_sum_dt = 0;
+    trend->slot_sum_p = 0;
+}
+
+bool pressure_trend_init(pressure_trend_t *trend, const pressure_trend_config_t *config)
+{
+    if (!trend) {
+        return false;
+    }
+
+    pressure_trend_config_t defaults = PRESSURE_TREND_DEFAULT_CONFIG();
+    if (!config) {
+        config = &defaults;
+    }
+
+    // Das volle Fenster muss in den Ringpuffer passen
+    if (config->slot_s == 0 ||
+        config->window_s / config->slot_s + 1 > PRESSURE_TREND_CAPACITY ||
+        config->min_span_s > config->window_s) {
+        return false;
+    }
+
+    *trend = (pressure_trend_t) {
+        .config = *config,
+    };
+    return true;
+}
+
+void pressure_trend_add(pressure_trend_t *trend, uint32_t time_s, uint32_t pressure_q8)
+{
+    if (trend->slot_count > 0 && time_s - trend->slot_start_s >= trend->config.slot_s) {
+        pressure_trend_close_slot(trend);
+    }
+
+    if (trend->slot_count == 0) {
+        trend->slot_start_s = time_s;
+    }
+
+    trend->slot_count++;
+    trend->slot_sum_dt += time_s - trend->slot_start_s;
+    trend->slot_sum_p += pressure_q8;
+}
+
+/**
+ * @brief Ordnet die 3h Änderung einer Tendenz-Klasse zu
+ */
+static pressure_tendency_t pressure_trend_classify(int32_t change_3h)
+{
+    int32_t magnitude = change_3h < 0 ? -change_3h : change_3h;
+    bool rising = change_3h > 0;
+
+    if (magnitude < PRESSURE_TREND_STEADY_PA) {
+        return PRESSURE_TENDENCY_STEADY;
+    } else if (magnitude <= PRESSURE_TREND_SLOWLY_PA) {
+        return rising ? PRESSURE_TENDENCY_RISING_SLOWLY : PRESSURE_TENDENCY_FALLING_SLOWLY;
+    } else if (magnitude <= PRESSURE_TREND_NORMAL_PA) {
+        return rising ? PRESSURE_TENDENCY_RISING : PRESSURE_TENDENCY_FALLING;
+    } else if (magnitude <= PRESSURE_TREND_QUICKLY_PA) {
+        return rising ? PRESSURE_TENDENCY_RISING_QUICKLY : PRESSURE_TENDENCY_FALLING_QUICKLY;
+    }
+    return rising ? PRESSURE_TENDENCY_RISING_VERY_RAPIDLY : PRESSURE_TENDENCY_FALLING_VERY_RAPIDLY;
+}
+
+void pressure_trend_get(const pressure_trend_t *trend, pressure_trend_result_t *result)
+{
+    *result = (pressure_trend_result_t) {
+        .tendency = PRESSURE_TENDENCY_UNKNOWN,
+        .points = trend->count,
+    };
+
+    if (trend->count < 3) {
+        return;
+    }
+
+    uint16_t newest = (trend->head + trend->count - 1) % PRESSURE_TREND_CAPACITY;
+    result->span_s = trend->points[newest].time_s - trend->points[trend->head].time_s;
+    if (result->span_s < trend->config.min_span_s) {
+        return;
+    }
+
+    // Steigung b = (n*sum(tp) - sum(t)*sum(p)) / (n*sum(tt) - sum(t)^2)
+    int64_t n = trend->count;
+    int64_t num = n * trend->sum_tp - trend->sum_t * trend->sum_p;
+    int64_t den = n * trend->sum_tt - trend->sum_t * trend->sum_t;
+    if (den <= 0) {
+        return;
+    }
+
+    result->slope = (int32_t)((num * SLOPE_SCALE_NUM) / (den * SLOPE_SCALE_DEN));
+    result->change_3h = result->slope * 3 / 100;
+    result->tendency = pressure_trend_classify(result->change_3h);
+}
+
+const char *pressure_tendency_name(pressure_tendency_t tendency)
+{
+    switch (tendency) {
+        case PRESSURE_TENDENCY_FALLING_VERY_RAPIDLY:
+            return "SEHR SCHNELL FALLEND";
+        case PRESSURE_TENDENCY_FALLING_QUICKLY:
+            return "SCHNELL FALLEND";
+        case PRESSURE_TENDENCY_FALLING:
+            return "FALLEND";
+        case PRESSURE_TENDENCY_FALLING_SLOWLY:
+            return "LANGSAM FALLEND";
+        case PRESSURE_TENDENCY_STEADY:
+            return "GLEICHBLEIBEND";
+        case PRESSURE_TENDENCY_RISING_SLOWLY:
+            return "LANGSAM STEIGEND";
+        case PRESSURE_TENDENCY_RISING:
+            return "STEIGEND";
+        case PRESSURE_TENDENCY_RISING_QUICKLY:
+            return "SCHNELL STEIGEND";
+        case PRESSURE_TENDENCY_RISING_VERY_RAPIDLY:
+            return "SEHR SCHNELL STEIGEND";
+        case PRESSURE_TENDENCY_UNKNOWN:
+        default:
+            return "UNBEKANNT";
+    }
+}
@@ -0,0 +1,128 @@
+/**
+ * Luftdruck-Tendenz für ESP32-C6 WeatherstationLight
+ *
+ * Schätzt die Steigung des Luftdrucks über ein gleitendes Zeitfenster
+ * (Standard 3h) mit der Methode der kleinsten Quadrate. Die Summen werden
+ * beim Hinzufügen und Entfernen von Stützpunkten inkrementell in Ganzzahlen
+ * nachgeführt: fester Speicher, amortisiert O(1) pro Messung und keine
+ * Rundungsdrift über die Laufzeit.
+ *
+ * Messungen werden in Zeitschlitzen gemittelt (Standard 3min), damit ein
+ * kurzes Messintervall das Fenster nicht verkürzt.
+ */
+
+#ifndef PRESSURE_TREND_H
+#define PRESSURE_TREND_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Stützpunkte im Ringpuffer (Fenster / Zeitschlitz muss hineinpassen)
+#define PRESSURE_TREND_CAPACITY      64
+
+// Standardwerte der Konfiguration
+#define PRESSURE_TREND_WINDOW_S      10800   // 3h Fenster
+#define PRESSURE_TREND_SLOT_S        180     // 3min Zeitschlitz
+#define PRESSURE_TREND_MIN_SPAN_S    3600    // Tendenz erst ab 1h Daten
+
+// Tendenz-Klassen nach 3h Änderung (Grenzen in Pa = 0.01 hPa)
+#define PRESSURE_TREND_STEADY_PA     10      // unter 0.1 hPa: gleichbleibend
+#define PRESSURE_TREND_SLOWLY_PA     150     // bis 1.5 hPa: langsam
+#define PRESSURE_TREND_NORMAL_PA     350     // bis 3.5 hPa
+#define PRESSURE_TREND_QUICKLY_PA    600     // bis 6.0 hPa: schnell, darüber sehr schnell
+
+// Luftdruck-Tendenz
+typedef enum {
+    PRESSURE_TENDENCY_UNKNOWN = 0,        // zu wenig Daten
+    PRESSURE_TENDENCY_FALLING_VERY_RAPIDLY,
+    PRESSURE_TENDENCY_FALLING_QUICKLY,
+    PRESSURE_TENDENCY_FALLING,
+    PRESSURE_TENDENCY_FALLING_SLOWLY,
+    PRESSURE_TENDENCY_STEADY,
+    PRESSURE_TENDENCY_RISING_SLOWLY,
+    PRESSURE_TENDENCY_RISING,
+    PRESSURE_TENDENCY_RISING_QUICKLY,
+    PRESSURE_TENDENCY_RISING_VERY_RAPIDLY,
+} pressure_tendency_t;
+
+// Konfiguration
+typedef struct {
+    uint32_t window_s;            // Länge des Fensters
+    uint32_t slot_s;              // Mittelungsdauer eines Stützpunkts
+    uint32_t min_span_s;          // minimale Datenspanne für eine Tendenz
+} pressure_trend_config_t;
+
+// Standardkonfiguration
+#define PRESSURE_TREND_DEFAULT_CONFIG() {        \
+    .window_s = PRESSURE_TREND_WINDOW_S,         \
+    .slot_s = PRESSURE_TREND_SLOT_S,             \
+    .min_span_s = PRESSURE_TREND_MIN_SPAN_S,     \
+}
+
+// Ergebnis der Trendschätzung
+typedef struct {
+    pressure_tendency_t tendency;
+    int32_t slope;                // Steigung in 0.01 Pa/h
+    int32_t change_3h;            // Änderung über 3h in Pa (0.01 hPa)
+    uint32_t span_s;              // Zeitspanne der Stützpunkte
+    uint16_t points;              // Anzahl Stützpunkte
+} pressure_trend_result_t;
+
+// Stützpunkt (Mittelwert eines Zeitschlitzes)
+typedef struct {
+    uint32_t time_s;
+    uint32_t pressure_q8;         // Pa in Q24.8
+} pressure_trend_point_t;
+
+// Zustand des Schätzers
+typedef struct {
+    pressure_trend_config_t config;
+    pressure_trend_point_t points[PRESSURE_TREND_CAPACITY];
+    uint16_t head;                // ältester Stützpunkt
+    uint16_t count;
+
+    // Laufende Summen, Zeiten relativ zu base_s
+    uint32_t base_s;
+    int64_t sum_t;
+    int64_t sum_p;
+    int64_t sum_tt;
+    int64_t sum_tp;
+
+    // Offener Zeitschlitz
+    uint32_t slot_start_s;
+    uint32_t slot_count;
+    uint64_t slot_sum_dt;
+    uint64_t slot_sum_p;
+} pressure_trend_t;
+
+/**
+ * @brief Initialisiert den Schätzer
+ * @param trend Pointer zum Zustand
+ * @param config Konfiguration, NULL für Standardkonfiguration
+ * @return true bei gültiger Konfiguration, sonst false
+ */
+bool pressure_trend_init(pressure_trend_t *trend, const pressure_trend_config_t *config);
+
+/**
+ * @brief Fügt eine Messung hinzu
+ * @param trend Pointer zum Zustand
+ * @param time_s Zeitstempel in Sekunden (monoton)
+ * @param pressure_q8 Luftdruck in Pa als Q24.8
+ */
+void pressure_trend_add(pressure_trend_t *trend, uint32_t time_s, uint32_t pressure_q8);
+
+/**
+ * @brief Liefert Steigung und Tendenz über das aktuelle Fenster
+ * @param trend Pointer zum Zustand
+ * @param result Pointer zur Ergebnisstruktur
+ */
+void pressure_trend_get(const pressure_trend_t *trend, pressure_trend_result_t *result);
+
+/**
+ * @brief Liefert den Namen einer Tendenz für die Log-Ausgabe
+ * @param tendency Tendenz
+ * @return Name der Tendenz
+ */
+const char *pressure_tendency_name(pressure_tendency_t tendency);
+
+#endif // PRESSURE_TREND_H
@@ -0,0 +1,187 @@
+/**
+ * Adaptiver Mess-Scheduler Implementation
+ * ESP32-C6 WeatherstationLight Project
+ */
+
+#include <stddef.h>
+#include "sampling_scheduler.h"
+
+// Nachkommabits der geglätteten Mittelwerte und des Glättungsfaktors
+#define AVG_SHIFT    16
+#define ALPHA_SHIFT  20
+
+// Temperaturgrenze in 0.01 °C, hält alle Produkte im int64 Bereich (weit ausserhalb des Sensorbereichs)
+#define TEMP_LIMIT_CENTI  (1 << 24)
+
+// Umrechnung der Abweichung (16 Nachkommabits) pro ms Zeitkonstante in 0.01 Pa/h bzw. 0.01 °C/h:
+// Pa: 3600000 * 100 / 2^16 = 703125 / 128, 0.01 °C: 3600000 / 2^16 = 28125 / 512
+#define PRESS_RATE_NUM 703125
+#define PRESS_RATE_DEN 128
+#define TEMP_RATE_NUM  28125
+#define TEMP_RATE_DEN  512
+
+/**
+ * @brief Betrag ohne libm
+ */
+static int32_t sampling_abs(int32_t value)
+{
+    return value < 0 ? -value : value;
+}
+
+/**
+ * @brief Aktualisiert einen geglätteten Mittelwert und liefert die Änderungsrate pro Stunde
+ *
+ * Der Mittelwert folgt einer linearen Änderung mit der Verzögerung rate * window,
+ * daher ergibt die Abweichung geteilt durch die Zeitkonstante die Änderungsrate.
+ * Das Rauschen einzelner Messungen geht nur mit 1/window in die Rate ein.
+ * Mittelwert und Abweichung werden mit 16 Nachkommabits gerechnet, damit auch
+ * kleine Schritte bei kurzen Intervallen (alpha ~ 0.003) erhalten bleiben.
+ *
+ * @param avg geglätteter Mittelwert (16 Nachkommabits)
+ * @param value Messwert (16 Nachkommabits)
+ * @param alpha Glättungsfaktor dt / (window + dt) (20 Nachkommabits)
+ * @param window_ms Zeitkonstante der Glättung
+ * @param scale_num Zähler der Umrechnung in die Rate pro Stunde
+ * @param scale_den Nenner der Umrechnung in die Rate pro Stunde
+ * @return Änderungsrate pro Stunde
+ */
+static int32_t sampling_update_rate(int64_t *avg, int64_t value, uint32_t alpha, uint32_t window_ms,
+                                   int64_t scale_num, int64_t scale_den)
+{
+    *avg += (value - *avg) * alpha / (1 << ALPHA_SHIFT);
+
+    int64_t rate = (value - *avg) * scale_num / ((int64_t)window_ms * scale_den);
+    if (rate > INT32_MAX) {
+        return INT32_MAX;
+    } else if (rate < -INT32_MAX) {
+        return -INT32_MAX;
+    }
+    return (int32_t)rate;
+}
+
+bool sampling_scheduler_init(sampling_scheduler_t *sched, const sampling_scheduler_config_t *config)
+{
+    if (!sched) {
+        return false;
+    }
+
+    sampling_scheduler_config_t defaults = SAMPLING_SCHEDULER_DEFAULT_CONFIG();
+    if (!config) {
+        config = &defaults;
+    }
+
+    // Grenzen und Hysterese prüfen
+    if (config->min_interval_ms == 0 ||
+        config->min_interval_ms > config->max_interval_ms ||
+        config->initial_interval_ms < config->min_interval_ms ||
+        config->initial_interval_ms > config->max_interval_ms ||
+        config->rate_window_ms == 0 ||
+        config->press_rate_low > config->press_rate_high ||
+        config->temp_rate_low > config->temp_rate_high ||
+        config->calm_samples == 0 ||
+        config->backoff_factor < 2) {
+        return false;
+    }
+
+    *sched = (sampling_scheduler_t) {
+        .config = *config,
+        .metrics = {
+            .interval_ms = config->initial_interval_ms,
+            .last_decision = SAMPLING_DECISION_HOLD,
+        },
+    };
+    return true;
+}
+
+uint32_t sampling_scheduler_update(sampling_scheduler_t *sched, uint32_t now_ms,
+                                   int32_t temperature_centi, uint32_t pressure_q8)
+{
+    const sampling_scheduler_config_t *cfg = &sched->config;
+    sampling_scheduler_metrics_t *m = &sched->metrics;
+
+    m->samples++;
+
+    if (temperature_centi > TEMP_LIMIT_CENTI) {
+        temperature_centi = TEMP_LIMIT_CENTI;
+    } else if (temperature_centi < -TEMP_LIMIT_CENTI) {
+        temperature_centi = -TEMP_LIMIT_CENTI;
+    }
+    int64_t pressure = (int64_t)pressure_q8 * (1 << (AVG_SHIFT - 8));
+    int64_t temperature = (int64_t)temperature_centi * (1 << AVG_SHIFT);
+
+    // Erste Messung: nur Mittelwerte setzen
+    if (!sched->has_sample) {
+        sched->press_avg = pressure;
+        sched->temp_avg = temperature;
+        sched->last_ms = now_ms;
+        sched->has_sample = true;
+        m->last_decision = SAMPLING_DECISION_HOLD;
+        return m->interval_ms;
+    }
+
+    uint32_t dt_ms = now_ms - sched->last_ms;
+    sched->last_ms = now_ms;
+    uint32_t alpha = (uint32_t)(((uint64_t)dt_ms << ALPHA_SHIFT) / ((uint64_t)cfg->rate_window_ms + dt_ms));
+
+    m->press_rate = sampling_update_rate(&sched->press_avg, pressure, alpha, cfg->rate_window_ms,
+                                         PRESS_RATE_NUM, PRESS_RATE_DEN);
+    m->temp_rate = sampling_update_rate(&sched->temp_avg, temperature, alpha, cfg->rate_window_ms,
+                                        TEMP_RATE_NUM, TEMP_RATE_DEN);
+
+    int32_t press_rate = sampling_abs(m->press_rate);
+    int32_t temp_rate = sampling_abs(m->temp_rate);
+
+    if (press_rate >= cfg->press_rate_high || temp_rate >= cfg->temp_rate_high) {
+        // Schnelle Änderung: sofort kürzestes Intervall
+        if (m->interval_ms != cfg->min_interval_ms) {
+            m->interval_ms = cfg->min_interval_ms;
+            m->fast_triggers++;
+        }
+        sched->calm_count = 0;
+        m->last_decision = SAMPLING_DECISION_FAST;
+    } else if (press_rate < cfg->press_rate_low && temp_rate < cfg->temp_rate_low) {
+        // Ruhige Bedingungen: Intervall nach mehreren ruhigen Messungen verlängern
+        m->last_decision = SAMPLING_DECISION_HOLD;
+        if (++sched->calm_count >= cfg->calm_samples) {
+            sched->calm_count = 0;
+            if (m->interval_ms < cfg->max_interval_ms) {
+                uint32_t next = m->interval_ms * cfg->backoff_factor;
+                if (next > cfg->max_interval_ms || next < m->interval_ms) {
+                    next = cfg->max_interval_ms;
+                }
+                m->interval_ms = next;
+                m->backoffs++;
+                m->last_decision = SAMPLING_DECISION_BACKOFF;
+            }
+        }
+    } else {
+        // Zwischen den Schwellen: Intervall halten (Hysterese)
+        sched->calm_count = 0;
+        m->last_decision = SAMPLING_DECISION_HOLD;
+    }
+
+    return m->interval_ms;
+}
+
+uint32_t sampling_scheduler_get_interval(const sampling_scheduler_t *sched)
+{
+    return sched->metrics.interval_ms;
+}
+
+const sampling_scheduler_metrics_t *sampling_scheduler_get_metrics(const sampling_scheduler_t *sched)
+{
+    return &sched->metrics;
+}
+
+const char *sampling_decision_name(sampling_decision_t decision)
+{
+    switch (decision) {
+        case SAMPLING_DECISION_FAST:
+            return "SCHNELL";
+        case SAMPLING_DECISION_BACKOFF:
+            return "VERLAENGERT";
+        case SAMPLING_DECISION_HOLD:
+        default:
+            return "HALTEN";
+    }
+}
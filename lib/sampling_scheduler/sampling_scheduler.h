@@ -0,0 +1,126 @@
+/**
+ * Adaptiver Mess-Scheduler für ESP32-C6 WeatherstationLight
+ *
+ * Bestimmt das BME280 Messintervall anhand der Änderungsrate von Luftdruck
+ * und Temperatur: schnelle Änderungen (Wetterfront, offenes Fenster) führen
+ * sofort zum kürzesten Intervall, ruhige Bedingungen verlängern das Intervall
+ * schrittweise bis zum längsten Intervall. Die Mittelwerte werden in Festkomma
+ * mit 16 Nachkommabits geführt, damit die Rate auch beim 2s Intervall aufgelöst bleibt.
+ */
+
+#ifndef SAMPLING_SCHEDULER_H
+#define SAMPLING_SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Standardwerte der Scheduler Konfiguration
+#define SAMPLING_MIN_INTERVAL_MS       2000     // 2s bei schnellen Änderungen
+#define SAMPLING_MAX_INTERVAL_MS       300000   // 5min bei ruhigen Bedingungen
+#define SAMPLING_INITIAL_INTERVAL_MS   10000    // 10s nach dem Start
+#define SAMPLING_RATE_WINDOW_MS        600000   // 10min Zeitkonstante der Glättung
+#define SAMPLING_PRESS_RATE_HIGH       10000    // 0.01 Pa/h, ab hier schnelles Intervall (100 Pa/h)
+#define SAMPLING_PRESS_RATE_LOW        5000     // 0.01 Pa/h, darunter gilt Luftdruck als ruhig (50 Pa/h)
+#define SAMPLING_TEMP_RATE_HIGH        200      // 0.01 °C/h, ab hier schnelles Intervall (2 °C/h)
+#define SAMPLING_TEMP_RATE_LOW         100      // 0.01 °C/h, darunter gilt Temperatur als ruhig (1 °C/h)
+#define SAMPLING_CALM_SAMPLES          3        // ruhige Messungen bis zur Verlängerung
+#define SAMPLING_BACKOFF_FACTOR        2        // Faktor der Intervall-Verlängerung
+
+// Entscheidung des Schedulers nach einer Messung
+typedef enum {
+    SAMPLING_DECISION_HOLD = 0,   // Intervall unverändert
+    SAMPLING_DECISION_FAST,       // schnelle Änderung erkannt, kürzestes Intervall
+    SAMPLING_DECISION_BACKOFF,    // ruhige Bedingungen, Intervall verlängert
+} sampling_decision_t;
+
+// Scheduler Konfiguration
+typedef struct {
+    uint32_t min_interval_ms;     // kürzestes Messintervall
+    uint32_t max_interval_ms;     // längstes Messintervall
+    uint32_t initial_interval_ms; // Intervall bis zur ersten Entscheidung
+    uint32_t rate_window_ms;      // Zeitkonstante der Änderungsraten-Schätzung
+    int32_t press_rate_high;      // 0.01 Pa/h, obere Schwelle (Hysterese)
+    int32_t press_rate_low;       // 0.01 Pa/h, untere Schwelle (Hysterese)
+    int32_t temp_rate_high;       // 0.01 °C/h, obere Schwelle (Hysterese)
+    int32_t temp_rate_low;        // 0.01 °C/h, untere Schwelle (Hysterese)
+    uint8_t calm_samples;         // ruhige Messungen in Folge bis zur Verlängerung
+    uint8_t backoff_factor;       // Multiplikator der Intervall-Verlängerung
+} sampling_scheduler_config_t;
+
+// Standardkonfiguration
+#define SAMPLING_SCHEDULER_DEFAULT_CONFIG() {                 \
+    .min_interval_ms = SAMPLING_MIN_INTERVAL_MS,              \
+    .max_interval_ms = SAMPLING_MAX_INTERVAL_MS,              \
+    .initial_interval_ms = SAMPLING_INITIAL_INTERVAL_MS,      \
+    .rate_window_ms = SAMPLING_RATE_WINDOW_MS,                \
+    .press_rate_high = SAMPLING_PRESS_RATE_HIGH,              \
+    .press_rate_low = SAMPLING_PRESS_RATE_LOW,                \
+    .temp_rate_high = SAMPLING_TEMP_RATE_HIGH,                \
+    .temp_rate_low = SAMPLING_TEMP_RATE_LOW,                  \
+    .calm_samples = SAMPLING_CALM_SAMPLES,                    \
+    .backoff_factor = SAMPLING_BACKOFF_FACTOR,                \
+}
+
+// Kennzahlen der Scheduler Entscheidungen
+typedef struct {
+    uint32_t samples;             // verarbeitete Messungen
+    uint32_t fast_triggers;       // Wechsel auf das kürzeste Intervall
+    uint32_t backoffs;            // Intervall-Verlängerungen
+    uint32_t interval_ms;         // aktuelles Messintervall
+    sampling_decision_t last_decision;
+    int32_t press_rate;           // geschätzte Luftdruck-Änderung in 0.01 Pa/h
+    int32_t temp_rate;            // geschätzte Temperatur-Änderung in 0.01 °C/h
+} sampling_scheduler_metrics_t;
+
+// Scheduler Zustand
+typedef struct {
+    sampling_scheduler_config_t config;
+    sampling_scheduler_metrics_t metrics;
+    int64_t press_avg;            // geglätteter Luftdruck (Pa, 16 Nachkommabits)
+    int64_t temp_avg;             // geglättete Temperatur (0.01 °C, 16 Nachkommabits)
+    uint32_t last_ms;             // Zeitstempel der letzten Messung
+    uint8_t calm_count;           // ruhige Messungen in Folge
+    bool has_sample;
+} sampling_scheduler_t;
+
+/**
+ * @brief Initialisiert den Scheduler
+ * @param sched Pointer zum Scheduler Zustand
+ * @param config Konfiguration, NULL für Standardkonfiguration
+ * @return true bei gültiger Konfiguration, sonst false
+ */
+bool sampling_scheduler_init(sampling_scheduler_t *sched, const sampling_scheduler_config_t *config);
+
+/**
+ * @brief Verarbeitet eine Messung und bestimmt das nächste Intervall
+ * @param sched Pointer zum Scheduler Zustand
+ * @param now_ms Zeitstempel der Messung in ms (Überlauf wird toleriert)
+ * @param temperature_centi Temperatur in 0.01 °C
+ * @param pressure_q8 Luftdruck in Pa (Q24.8)
+ * @return Intervall bis zur nächsten Messung in ms
+ */
+uint32_t sampling_scheduler_update(sampling_scheduler_t *sched, uint32_t now_ms,
+                                   int32_t temperature_centi, uint32_t pressure_q8);
+
+/**
+ * @brief Liefert das aktuelle Messintervall
+ * @param sched Pointer zum Scheduler Zustand
+ * @return Intervall in ms
+ */
+uint32_t sampling_scheduler_get_interval(const sampling_scheduler_t *sched);
+
+/**
+ * @brief Liefert die Kennzahlen der bisherigen Entscheidungen
+ * @param sched Pointer zum Scheduler Zustand
+ * @return Pointer auf die Kennzahlen
+ */
+const sampling_scheduler_metrics_t *sampling_scheduler_get_metrics(const sampling_scheduler_t *sched);
+
+/**
+ * @brief Liefert den Namen einer Entscheidung für die Log-Ausgabe
+ * @param decision Entscheidung
+ * @return Name der Entscheidung
+ */
+const char *sampling_decision_name(sampling_decision_t decision);
+
+#endif // SAMPLING_SCHEDULER_H
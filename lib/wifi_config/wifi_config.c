@@ -3,6 +3,7 @@
  */
 
 #include "wifi_config.h"
+#include "sdkconfig.h"
 #include "../../src/credentials.h"
 #include "esp_log.h"
 #include "esp_netif.h"
@@ -14,6 +15,9 @@ static const char *TAG = "WIFI_CONFIG";
 
 // Event Group für WLAN Status
 static EventGroupHandle_t s_wifi_event_group;
+#if CONFIG_WEATHERSTATION_STATIC_ALLOC
+static StaticEventGroup_t s_wifi_event_group_buffer;
+#endif
 #define WIFI_CONNECTED_BIT BIT0
 #define WIFI_FAIL_BIT      BIT1
 
@@ -65,7 +69,11 @@ esp_err_t wifi_init(void)
     ESP_ERROR_CHECK(ret);
     
     // Event Group erstellen
+#if CONFIG_WEATHERSTATION_STATIC_ALLOC
+    s_wifi_event_group = xEventGroupCreateStatic(&s_wifi_event_group_buffer);
+#else
     s_wifi_event_group = xEventGroupCreate();
+#endif
     
     // Netzwerk Interface initialisieren
     ESP_ERROR_CHECK(esp_netif_init());
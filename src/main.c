@@ -1,21 +1,36 @@
 /**
  * ESP32-C6 WeatherstationLight
  * 
- * BME280 Sensor Test mit Blink-LED und WLAN-Verbindung
+ * BME280 Sensor mit Status-LED und WLAN-Verbindung
  */
 #include <stdio.h>
+#include "sdkconfig.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "bme280.h"
 #include "wifi_config.h"
+#include "sampling_scheduler.h"
+#include "derived_metrics.h"
+#include "pressure_trend.h"
+#include "mem_report.h"
 
 // LED Pin (Port 15)
 #define LED_PIN 15
 
+// Stationshöhe für die Reduktion auf Meereshöhe
+#define STATION_ALTITUDE_CM 0   // in cm, anpassen bei Bedarf
+
 static const char *TAG = "WEATHERSTATION";
 
+// Adaptiver Mess-Scheduler (statisch, kein Heap)
+static sampling_scheduler_t s_scheduler;
+
+// Luftdruck-Tendenz über die letzten 3h (statisch, kein Heap)
+static pressure_trend_t s_trend;
+
 void app_main(void)
 {
     // Startnachricht mit Verzögerung zum besseren Monitoroutput anzeigen
@@ -50,7 +65,7 @@ void app_main(void)
     esp_err_t ret = bme280_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "BME280 Initialisierung fehlgeschlagen: %s", esp_err_to_name(ret));
-        ESP_LOGI(TAG, "Nur LED-Blink Modus aktiv");
+        ESP_LOGI(TAG, "Nur LED-Statusanzeige aktiv");
     } else {
         // BME280 konfigurieren
         ret = bme280_config();
@@ -61,20 +76,29 @@ void app_main(void)
         }
     }
     
+    // Mess-Scheduler initialisieren
+    sampling_scheduler_init(&s_scheduler, NULL);
+    pressure_trend_init(&s_trend, NULL);
+    TickType_t next_measurement = xTaskGetTickCount() + pdMS_TO_TICKS(sampling_scheduler_get_interval(&s_scheduler));
+    
+    // Initialisierung abgeschlossen: Referenz für den Speicherbericht setzen
+    mem_report_boot_complete();
+    TickType_t next_mem_report = xTaskGetTickCount() + pdMS_TO_TICKS(CONFIG_WEATHERSTATION_MEM_REPORT_INTERVAL_S * 1000ULL);
+    
     // Hauptschleife
-    int blink_count = 0;
     while (1) {
-        // LED blinken
-        gpio_set_level(LED_PIN, 1);
-        ESP_LOGI(TAG, "LED AN (Blink #%d)", ++blink_count);
-        vTaskDelay(pdMS_TO_TICKS(500));
-        
-        gpio_set_level(LED_PIN, 0);
-        ESP_LOGI(TAG, "LED AUS");
-        vTaskDelay(pdMS_TO_TICKS(500));
+        // Bis zur nächsten Messung blockieren
+        TickType_t now = xTaskGetTickCount();
+        if ((int32_t)(next_measurement - now) > 0) {
+            vTaskDelay(next_measurement - now);
+            now = xTaskGetTickCount();
+        }
         
-        // Alle 10 Blinks: BME280 Messung und WLAN Status (falls verfügbar)
-        if (blink_count % 10 == 0) {
+        // Nach Ablauf des Scheduler Intervalls: BME280 Messung und WLAN Status (falls verfügbar)
+        if ((int32_t)(now - next_measurement) >= 0) {
+            // LED leuchtet während der Messung als Lebenszeichen
+            gpio_set_level(LED_PIN, 1);
+            
             // WLAN Status prüfen
             if (wifi_is_connected()) {
                 ESP_LOGI(TAG, "WLAN Status: VERBUNDEN");
@@ -82,17 +106,54 @@ void app_main(void)
                 ESP_LOGW(TAG, "WLAN Status: NICHT VERBUNDEN");
             }
             
-            // BME280 Messung
+            // BME280 Messung, Sekunden-Zeitstempel der Tendenz aus esp_timer (now / configTICK_RATE_HZ springt beim Tick-Überlauf)
             bme280_data_t data;
             ret = bme280_measure(&data);
+            int64_t uptime_us = esp_timer_get_time();
             if (ret == ESP_OK) {
                 ESP_LOGI(TAG, "BME280 Messung:");
                 ESP_LOGI(TAG, "  Temperatur: %.2f °C", data.temperature);
                 ESP_LOGI(TAG, "  Luftdruck:  %.2f hPa", data.pressure / 100.0f);
                 ESP_LOGI(TAG, "  Luftfeuchtigkeit: %.2f %%", data.humidity);
+                
+                // Abgeleitete Werte (Festkomma, ohne libm)
+                derived_metrics_t derived;
+                derived_metrics_compute(data.temperature_centi, data.pressure_q8, data.humidity_q10,
+                                        STATION_ALTITUDE_CM, &derived);
+                ESP_LOGI(TAG, "  Taupunkt: %.2f °C", derived.dew_point / 100.0f);
+                ESP_LOGI(TAG, "  Absolute Feuchte: %.2f g/m³", derived.absolute_humidity / 1000.0f);
+                ESP_LOGI(TAG, "  Höhe (1013.25 hPa): %.1f m", derived.altitude / 100.0f);
+                ESP_LOGI(TAG, "  Luftdruck Meereshöhe: %.2f hPa", derived.sea_level_pressure_q8 / 25600.0f);
+                
+                // Luftdruck-Tendenz aktualisieren
+                pressure_trend_result_t trend;
+                pressure_trend_add(&s_trend, (uint32_t)(uptime_us / 1000000), data.pressure_q8);
+                pressure_trend_get(&s_trend, &trend);
+                ESP_LOGI(TAG, "  Tendenz: %s (%.2f hPa/3h, %.2f Pa/h, %u Stützpunkte)",
+                         pressure_tendency_name(trend.tendency), trend.change_3h / 100.0f,
+                         trend.slope / 100.0f, trend.points);
+                
+                // Nächstes Intervall anhand der Änderungsrate bestimmen
+                sampling_scheduler_update(&s_scheduler, pdTICKS_TO_MS(now), data.temperature_centi, data.pressure_q8);
+                const sampling_scheduler_metrics_t *metrics = sampling_scheduler_get_metrics(&s_scheduler);
+                ESP_LOGI(TAG, "Scheduler: %s, Intervall %lu ms (dP %.1f Pa/h, dT %.2f °C/h)",
+                         sampling_decision_name(metrics->last_decision), (unsigned long)metrics->interval_ms,
+                         metrics->press_rate / 100.0f, metrics->temp_rate / 100.0f);
+                ESP_LOGI(TAG, "  Messungen: %lu, Schnell: %lu, Verlängert: %lu",
+                         (unsigned long)metrics->samples, (unsigned long)metrics->fast_triggers,
+                         (unsigned long)metrics->backoffs);
             } else {
                 ESP_LOGW(TAG, "BME280 Messung fehlgeschlagen: %s", esp_err_to_name(ret));
             }
+            
+            gpio_set_level(LED_PIN, 0);
+            next_measurement = now + pdMS_TO_TICKS(sampling_scheduler_get_interval(&s_scheduler));
+            
+            // Speicherbericht mit der ersten Messung nach Fälligkeit (kein eigenes Aufwachen)
+            if ((int32_t)(now - next_mem_report) >= 0) {
+                mem_report_log();
+                next_mem_report = now + pdMS_TO_TICKS(CONFIG_WEATHERSTATION_MEM_REPORT_INTERVAL_S * 1000ULL);
+            }
         }
     }
 }
@@ -0,0 +1,39 @@
+/**
+ * Laufzeitmessung für die Host-Tests
+ *
+ * Die Werte dienen nur dem Vergleich auf dem Host, auf dem ESP32-C6 gelten
+ * andere Verhältnisse (kein FPU, anderer Takt).
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include <unity.h>
+
+/**
+ * @brief Startet eine Messung
+ * @return Prozessorzeit beim Start
+ */
+static inline clock_t bench_start(void)
+{
+    return clock();
+}
+
+/**
+ * @brief Gibt die Laufzeit pro Aufruf seit bench_start() als Testmeldung aus
+ * @param name Bezeichnung der Messung
+ * @param start Rückgabewert von bench_start()
+ * @param iterations Anzahl Aufrufe
+ */
+static inline void bench_report(const char *name, clock_t start, uint32_t iterations)
+{
+    char msg[96];
+    double ns = (double)(clock() - start) / CLOCKS_PER_SEC / iterations * 1e9;
+    snprintf(msg, sizeof(msg), "%s: %.1f ns/Aufruf", name, ns);
+    TEST_MESSAGE(msg);
+}
+
+#endif // BENCH_H
@@ -0,0 +1,215 @@
+/**
+ * Host-Test für die abgeleiteten Wetterwerte
+ *
+ * Vergleicht die Festkomma-Berechnung mit den Referenzformeln in double über
+ * den dokumentierten Wertebereich (siehe derived_metrics.h), prüft die
+ * erzeugten Tabellen und misst die Laufzeit pro Messung.
+ *
+ * Aufruf: pio test -e native -f test_derived_metrics -v
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <unity.h>
+#include "derived_metrics.h"
+#include "derived_metrics_tables.h"
+#include "../bench.h"
+
+// Dokumentierte Fehlergrenzen (derived_metrics.h)
+#define BOUND_DEW_POINT_C        0.011   // °C
+#define BOUND_ABS_HUMIDITY_MG    1.4     // mg/m³
+#define BOUND_ABS_HUMIDITY_REL   5.1e-4  // ab 1 g/m³
+#define BOUND_ALTITUDE_M         0.06    // m
+#define BOUND_SEA_LEVEL_PA       1.8     // Pa im gesamten Bereich
+#define BOUND_SEA_LEVEL_REL      1.2e-5
+#define BOUND_SEA_LEVEL_LOW_PA   1.3     // Pa für h <= 2000 m, p >= 800 hPa
+
+// Referenzformeln (double, libm)
+static double ref_dew_point(double t, double rh)
+{
+    double gamma = log(rh / 100.0) + 17.62 * t / (243.12 + t);
+    return 243.12 * gamma / (17.62 - gamma);
+}
+
+static double ref_absolute_humidity_mg(double t, double rh)
+{
+    double e = 6.112 * exp(17.62 * t / (243.12 + t)) * rh / 100.0;
+    return 216.7 * e / (t + 273.15) * 1000.0;
+}
+
+static double ref_altitude_m(double p, double p0)
+{
+    return 44330.77 * (1.0 - pow(p / p0, 1.0 / 5.25588));
+}
+
+static double ref_sea_level_pa(double p, double h)
+{
+    return p / pow(1.0 - h / 44330.77, 5.25588);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_tables_match_reference(void)
+{
+    const int n = 1 << DM_TABLE_BITS;
+
+    for (int i = 0; i <= n; i++) {
+        double log2_ref = log2(1.0 + (double)i / n) * (1 << DM_LOG2_FRAC);
+        double exp2_ref = pow(2.0, (double)i / n) * (1 << DM_EXP2_FRAC);
+        TEST_ASSERT_TRUE_MESSAGE(fabs(dm_log2_table[i] - log2_ref) <= 0.5, "dm_log2_table");
+        TEST_ASSERT_TRUE_MESSAGE(fabs(dm_exp2_table[i] - exp2_ref) <= 0.5, "dm_exp2_table");
+    }
+}
+
+void test_dew_point_accuracy(void)
+{
+    double max_err = 0.0;
+
+    for (int32_t t = -4000; t <= 8500; t += 7) {
+        for (uint32_t h = 1024; h <= 102400; h += 37) {
+            double ref = ref_dew_point(t / 100.0, h / 1024.0);
+            double err = fabs(derived_dew_point(t, h) / 100.0 - ref);
+            if (err > max_err) {
+                max_err = err;
+            }
+        }
+    }
+
+    char msg[64];
+    snprintf(msg, sizeof(msg), "Taupunkt max. Fehler: %.4f °C", max_err);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE_MESSAGE(max_err <= BOUND_DEW_POINT_C, msg);
+}
+
+void test_absolute_humidity_accuracy(void)
+{
+    double max_err = 0.0;
+    double max_rel = 0.0;
+
+    for (int32_t t = -4000; t <= 8500; t += 7) {
+        for (uint32_t h = 1024; h <= 102400; h += 37) {
+            double ref = ref_absolute_humidity_mg(t / 100.0, h / 1024.0);
+            double err = fabs((double)derived_absolute_humidity(t, h) - ref);
+            if (err > max_err) {
+                max_err = err;
+            }
+            if (ref >= 1000.0 && err / ref > max_rel) {
+                max_rel = err / ref;
+            }
+        }
+    }
+
+    char msg[80];
+    snprintf(msg, sizeof(msg), "Absolute Feuchte max. Fehler: %.3f mg/m³ (%.2e relativ)", max_err, max_rel);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE_MESSAGE(max_err <= BOUND_ABS_HUMIDITY_MG, msg);
+    TEST_ASSERT_TRUE_MESSAGE(max_rel <= BOUND_ABS_HUMIDITY_REL, msg);
+}
+
+void test_altitude_accuracy(void)
+{
+    double max_err = 0.0;
+
+    for (uint32_t p = 30000u * 256u; p <= 110000u * 256u; p += 11) {
+        double ref = ref_altitude_m(p / 256.0, 101325.0);
+        double err = fabs(derived_altitude(p, DERIVED_REFERENCE_PRESSURE_Q8) / 100.0 - ref);
+        if (err > max_err) {
+            max_err = err;
+        }
+    }
+
+    char msg[64];
+    snprintf(msg, sizeof(msg), "Höhe max. Fehler: %.4f m", max_err);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE_MESSAGE(max_err <= BOUND_ALTITUDE_M, msg);
+}
+
+void test_sea_level_pressure_accuracy(void)
+{
+    double max_err = 0.0;
+    double max_rel = 0.0;
+    double max_err_low = 0.0;
+
+    for (uint32_t p = 30000u * 256u; p <= 110000u * 256u; p += 997) {
+        for (int32_t h = -50000; h <= 900000; h += 2501) {
+            double ref = ref_sea_level_pa(p / 256.0, h / 100.0);
+            double err = fabs(derived_sea_level_pressure(p, h) / 256.0 - ref);
+            if (err > max_err) {
+                max_err = err;
+            }
+            if (err / ref > max_rel) {
+                max_rel = err / ref;
+            }
+            if (h <= 200000 && p >= 80000u * 256u && err > max_err_low) {
+                max_err_low = err;
+            }
+        }
+    }
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "Luftdruck Meereshöhe max. Fehler: %.3f Pa (%.2e relativ, %.3f Pa bis 2000 m)",
+             max_err, max_rel, max_err_low);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE_MESSAGE(max_err <= BOUND_SEA_LEVEL_PA, msg);
+    TEST_ASSERT_TRUE_MESSAGE(max_rel <= BOUND_SEA_LEVEL_REL, msg);
+    TEST_ASSERT_TRUE_MESSAGE(max_err_low <= BOUND_SEA_LEVEL_LOW_PA, msg);
+}
+
+void test_zero_inputs_are_defined(void)
+{
+    // Luftdruck 0 (Kalibrierungsfehler) und Feuchte 0 dürfen nicht zu log2(0) führen
+    derived_metrics_t out;
+    derived_metrics_compute(2000, 0, 0, 0, &out);
+    TEST_ASSERT_TRUE(out.altitude > 0);
+    TEST_ASSERT_TRUE(out.sea_level_pressure_q8 <= 1);
+    TEST_ASSERT_TRUE(out.dew_point < -8000);
+    TEST_ASSERT_EQUAL_UINT32(0, out.absolute_humidity);
+}
+
+void test_benchmark(void)
+{
+    // Hinweis: der Host rechnet double in Hardware, auf dem ESP32-C6 läuft libm in Soft-Float
+    const int iterations = 1000000;
+    volatile uint32_t sink = 0;
+    volatile double sink_ref = 0.0;
+    derived_metrics_t out;
+
+    clock_t start = bench_start();
+    for (int i = 0; i < iterations; i++) {
+        derived_metrics_compute(2000 + (i & 1023), 101325u * 256u + (uint32_t)i, 50u * 1024u + (i & 4095),
+                                50000, &out);
+        sink += (uint32_t)out.dew_point + out.absolute_humidity + (uint32_t)out.altitude + out.sea_level_pressure_q8;
+    }
+    bench_report("Festkomma", start, iterations);
+
+    start = bench_start();
+    for (int i = 0; i < iterations; i++) {
+        double t = 20.0 + (i & 1023) / 100.0;
+        double p = 101325.0 + i / 256.0;
+        double rh = 50.0 + (i & 4095) / 1024.0;
+        sink_ref += ref_dew_point(t, rh) + ref_absolute_humidity_mg(t, rh)
+                  + ref_altitude_m(p, 101325.0) + ref_sea_level_pa(p, 500.0);
+    }
+    bench_report("double libm", start, iterations);
+    (void)sink;
+    (void)sink_ref;
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_tables_match_reference);
+    RUN_TEST(test_dew_point_accuracy);
+    RUN_TEST(test_absolute_humidity_accuracy);
+    RUN_TEST(test_altitude_accuracy);
+    RUN_TEST(test_sea_level_pressure_accuracy);
+    RUN_TEST(test_zero_inputs_are_defined);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
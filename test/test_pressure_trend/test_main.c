@@ -0,0 +1,191 @@
+/**
+ * Host-Test und Benchmark für die Luftdruck-Tendenz
+ *
+ * Synthetische Fronten mit Sensorrauschen: 2h ruhig, Kaltfront mit
+ * -4 hPa/3h über 4h, danach Anstieg mit +2.5 hPa/h. Prüft Konvergenz der
+ * Steigung, die Tendenz-Klassen, Überlauf der Zeitstempel, Driftfreiheit der
+ * laufenden Summen und misst die Kosten pro Messung.
+ *
+ * Aufruf: pio test -e native -f test_pressure_trend -v
+ */
+
+#include <unity.h>
+#include "pressure_trend.h"
+#include "../bench.h"
+
+#define SAMPLE_INTERVAL_S  10
+#define FRONT_START_S      (2 * 3600)
+#define RISE_START_S       (6 * 3600)
+#define TRACE_END_S        (12 * 3600)
+
+// Festes Rauschmuster in Pa (Mittelwert 0), wiederholt sich alle 7 Messungen
+static const int8_t s_noise_pa[] = { 3, -2, 0, -3, 1, 2, -1 };
+
+static pressure_trend_t s_trend;
+
+/**
+ * @brief Sensorrauschen der Messung zum Zeitpunkt t
+ */
+static int trace_noise(uint32_t t)
+{
+    return s_noise_pa[(t / SAMPLE_INTERVAL_S) % sizeof(s_noise_pa)];
+}
+
+/**
+ * @brief Synthetischer Luftdruck in Pa zum Zeitpunkt t (relativ zum Start)
+ */
+static double trace_pressure(uint32_t t)
+{
+    if (t < FRONT_START_S) {
+        return 101325.0;
+    }
+    if (t < RISE_START_S) {
+        return 101325.0 - 400.0 * (t - FRONT_START_S) / 10800.0;
+    }
+    return 101325.0 - 400.0 * (RISE_START_S - FRONT_START_S) / 10800.0 + 250.0 * (t - RISE_START_S) / 3600.0;
+}
+
+/**
+ * @brief Spielt den Verlauf bis end_s ab, Zeitstempel beginnen bei start_time_s
+ */
+static void trace_run(uint32_t start_time_s, uint32_t from_s, uint32_t end_s)
+{
+    for (uint32_t t = from_s; t < end_s; t += SAMPLE_INTERVAL_S) {
+        uint32_t pressure_q8 = (uint32_t)((trace_pressure(t) + trace_noise(t)) * 256.0 + 0.5);
+        pressure_trend_add(&s_trend, start_time_s + t, pressure_q8);
+    }
+}
+
+void setUp(void)
+{
+    TEST_ASSERT_TRUE(pressure_trend_init(&s_trend, NULL));
+}
+
+void tearDown(void)
+{
+}
+
+void test_rejects_window_larger_than_ring(void)
+{
+    pressure_trend_config_t config = PRESSURE_TREND_DEFAULT_CONFIG();
+    config.slot_s = 60;
+    TEST_ASSERT_FALSE(pressure_trend_init(&s_trend, &config));
+}
+
+void test_unknown_until_min_span(void)
+{
+    pressure_trend_result_t result;
+
+    trace_run(0, 0, 3000);
+    pressure_trend_get(&s_trend, &result);
+    TEST_ASSERT_EQUAL(PRESSURE_TENDENCY_UNKNOWN, result.tendency);
+
+    trace_run(0, 3000, FRONT_START_S);
+    pressure_trend_get(&s_trend, &result);
+    TEST_ASSERT_EQUAL(PRESSURE_TENDENCY_STEADY, result.tendency);
+    TEST_ASSERT_INT_WITHIN(10, 0, result.change_3h);
+}
+
+void test_synthetic_fronts_converge(void)
+{
+    pressure_trend_result_t result;
+
+    // Fenster vollständig in der Kaltfront: -400 Pa/3h
+    trace_run(0, 0, RISE_START_S);
+    pressure_trend_get(&s_trend, &result);
+    TEST_ASSERT_INT_WITHIN(5, -400, result.change_3h);
+    TEST_ASSERT_INT_WITHIN(200, -13333, result.slope);
+    TEST_ASSERT_EQUAL(PRESSURE_TENDENCY_FALLING_QUICKLY, result.tendency);
+    TEST_ASSERT_TRUE(result.points <= PRESSURE_TREND_CAPACITY);
+    TEST_ASSERT_TRUE(result.span_s <= PRESSURE_TREND_WINDOW_S);
+
+    // Fenster vollständig im Anstieg: +750 Pa/3h
+    trace_run(0, RISE_START_S, TRACE_END_S);
+    pressure_trend_get(&s_trend, &result);
+    TEST_ASSERT_INT_WITHIN(5, 750, result.change_3h);
+    TEST_ASSERT_EQUAL(PRESSURE_TENDENCY_RISING_VERY_RAPIDLY, result.tendency);
+}
+
+void test_timestamp_wraparound(void)
+{
+    // Gleicher Verlauf, Zeitstempel laufen während der Front über 2^32 s
+    pressure_trend_result_t wrapped;
+    pressure_trend_result_t reference;
+
+    trace_run(UINT32_MAX - 4 * 3600u, 0, RISE_START_S);
+    pressure_trend_get(&s_trend, &wrapped);
+
+    setUp();
+    trace_run(0, 0, RISE_START_S);
+    pressure_trend_get(&s_trend, &reference);
+
+    TEST_ASSERT_EQUAL(reference.tendency, wrapped.tendency);
+    TEST_ASSERT_EQUAL_INT32(reference.slope, wrapped.slope);
+    TEST_ASSERT_EQUAL(reference.points, wrapped.points);
+}
+
+void test_running_sums_do_not_drift(void)
+{
+    // Nach vielen Verdrängungen muss die Steigung der direkten Berechnung entsprechen
+    for (uint32_t t = 0; t < 200u * 3600u; t += SAMPLE_INTERVAL_S) {
+        uint32_t pressure_q8 = (uint32_t)((101325.0 + 300.0 * ((t / 7200u) % 2 ? 1 : -1) + trace_noise(t)) * 256.0);
+        pressure_trend_add(&s_trend, t, pressure_q8);
+    }
+
+    // Laufende Summen exakt gegen die Neuberechnung aus dem Ringpuffer prüfen
+    int64_t sum_t = 0, sum_p = 0, sum_tt = 0, sum_tp = 0;
+    for (uint16_t i = 0; i < s_trend.count; i++) {
+        const pressure_trend_point_t *point = &s_trend.points[(s_trend.head + i) % PRESSURE_TREND_CAPACITY];
+        int64_t t = (uint32_t)(point->time_s - s_trend.base_s);
+        sum_t += t;
+        sum_p += point->pressure_q8;
+        sum_tt += t * t;
+        sum_tp += t * point->pressure_q8;
+    }
+    TEST_ASSERT_TRUE(sum_t == s_trend.sum_t);
+    TEST_ASSERT_TRUE(sum_p == s_trend.sum_p);
+    TEST_ASSERT_TRUE(sum_tt == s_trend.sum_tt);
+    TEST_ASSERT_TRUE(sum_tp == s_trend.sum_tp);
+
+    // Steigung gegen die direkte Berechnung in double
+    double n = s_trend.count;
+    double slope = (n * (double)sum_tp - (double)sum_t * (double)sum_p) /
+                   (n * (double)sum_tt - (double)sum_t * (double)sum_t) * 3600.0 * 100.0 / 256.0;
+
+    pressure_trend_result_t result;
+    pressure_trend_get(&s_trend, &result);
+    TEST_ASSERT_INT_WITHIN(1, (int32_t)slope, result.slope);
+}
+
+void test_benchmark(void)
+{
+    const uint32_t iterations = 10000000;
+    pressure_trend_result_t result;
+    volatile int32_t sink = 0;
+
+    clock_t start = bench_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        pressure_trend_add(&s_trend, i * SAMPLE_INTERVAL_S, 101325u * 256u + (i & 2047));
+    }
+    bench_report("pressure_trend_add", start, iterations);
+
+    start = bench_start();
+    for (uint32_t i = 0; i < iterations; i++) {
+        pressure_trend_get(&s_trend, &result);
+        sink += result.slope;
+    }
+    bench_report("pressure_trend_get", start, iterations);
+    (void)sink;
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_rejects_window_larger_than_ring);
+    RUN_TEST(test_unknown_until_min_span);
+    RUN_TEST(test_synthetic_fronts_converge);
+    RUN_TEST(test_timestamp_wraparound);
+    RUN_TEST(test_running_sums_do_not_drift);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
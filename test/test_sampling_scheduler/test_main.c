@@ -0,0 +1,266 @@
+/**
+ * Host-Test für den adaptiven Mess-Scheduler
+ *
+ * Spielt synthetische Verläufe (Stützpunkte mit linearer Interpolation und
+ * reproduzierbarem Sensorrauschen) durch sampling_scheduler_update und prüft
+ * die Folge der Intervalle und Entscheidungen.
+ *
+ * Aufruf: pio test -e native -f test_sampling_scheduler
+ */
+
+#include <stdint.h>
+#include <unity.h>
+#include "sampling_scheduler.h"
+
+// Stützpunkt eines synthetischen Verlaufs
+typedef struct {
+    uint32_t time_s;
+    float temperature;            // °C
+    float pressure;               // Pa
+} trace_point_t;
+
+// Ruhig, Fenster offen bei 1h (-4 °C in 100s), ruhig, Kaltfront ab 3h (-250 Pa/h)
+static const trace_point_t s_trace[] = {
+    {     0, 21.0f, 101325.0f },
+    {  3600, 21.0f, 101325.0f },
+    {  3700, 17.0f, 101325.0f },
+    { 10800, 17.0f, 101325.0f },
+    { 18000, 17.0f, 100825.0f },
+};
+
+#define TRACE_LEN (sizeof(s_trace) / sizeof(s_trace[0]))
+
+static sampling_scheduler_t s_sched;
+static uint32_t s_noise_state;
+
+/**
+ * @brief Reproduzierbares Rauschen in [-1, 1]
+ */
+static float trace_noise(void)
+{
+    s_noise_state = s_noise_state * 1103515245u + 12345u;
+    return ((float)((s_noise_state >> 16) & 0x7FFF) / 16383.5f) - 1.0f;
+}
+
+/**
+ * @brief Liest den Verlauf zum Zeitpunkt t_ms (linear interpoliert, mit Sensorrauschen)
+ */
+static void trace_sample(uint32_t t_ms, int32_t *temperature_centi, uint32_t *pressure_q8)
+{
+    float t = t_ms / 1000.0f;
+    size_t i = 0;
+    while (i + 2 < TRACE_LEN && t >= s_trace[i + 1].time_s) {
+        i++;
+    }
+
+    const trace_point_t *a = &s_trace[i];
+    const trace_point_t *b = &s_trace[i + 1];
+    float f = (t - a->time_s) / (float)(b->time_s - a->time_s);
+    if (f > 1.0f) {
+        f = 1.0f;
+    }
+
+    float temperature = a->temperature + f * (b->temperature - a->temperature) + 0.01f * trace_noise();
+    float pressure = a->pressure + f * (b->pressure - a->pressure) + 2.0f * trace_noise();
+    *temperature_centi = (int32_t)(temperature * 100.0f + (temperature < 0.0f ? -0.5f : 0.5f));
+    *pressure_q8 = (uint32_t)(pressure * 256.0f + 0.5f);
+}
+
+void setUp(void)
+{
+    s_noise_state = 1;
+    TEST_ASSERT_TRUE(sampling_scheduler_init(&s_sched, NULL));
+}
+
+void tearDown(void)
+{
+}
+
+void test_rejects_invalid_config(void)
+{
+    sampling_scheduler_config_t config = SAMPLING_SCHEDULER_DEFAULT_CONFIG();
+    config.min_interval_ms = config.max_interval_ms + 1;
+    TEST_ASSERT_FALSE(sampling_scheduler_init(&s_sched, &config));
+
+    config = (sampling_scheduler_config_t)SAMPLING_SCHEDULER_DEFAULT_CONFIG();
+    config.press_rate_low = config.press_rate_high + 1;
+    TEST_ASSERT_FALSE(sampling_scheduler_init(&s_sched, &config));
+
+    config = (sampling_scheduler_config_t)SAMPLING_SCHEDULER_DEFAULT_CONFIG();
+    config.backoff_factor = 1;
+    TEST_ASSERT_FALSE(sampling_scheduler_init(&s_sched, &config));
+}
+
+void test_calm_backs_off_to_max(void)
+{
+    // 10s Start, nach je 3 ruhigen Messungen verdoppeln bis 5min
+    static const uint32_t expected[] = {
+        10000, 10000, 10000, 20000, 20000, 20000, 40000, 40000, 40000,
+        80000, 80000, 80000, 160000, 160000, 160000, 300000, 300000,
+    };
+    uint32_t t_ms = 0;
+
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++) {
+        int32_t temperature_centi;
+        uint32_t pressure_q8;
+        trace_sample(t_ms, &temperature_centi, &pressure_q8);
+        uint32_t interval = sampling_scheduler_update(&s_sched, t_ms, temperature_centi, pressure_q8);
+        TEST_ASSERT_EQUAL_UINT32(expected[i], interval);
+        TEST_ASSERT_TRUE(sampling_scheduler_get_metrics(&s_sched)->last_decision != SAMPLING_DECISION_FAST);
+        t_ms += interval;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(5, sampling_scheduler_get_metrics(&s_sched)->backoffs);
+}
+
+void test_trace_window_and_front(void)
+{
+    uint32_t t_ms = 0;
+    uint32_t window_detect_ms = 0;
+    uint32_t front_detect_ms = 0;
+    uint32_t fast_samples = 0;
+
+    while (t_ms < s_trace[TRACE_LEN - 1].time_s * 1000u) {
+        int32_t temperature_centi;
+        uint32_t pressure_q8;
+        trace_sample(t_ms, &temperature_centi, &pressure_q8);
+        uint32_t interval = sampling_scheduler_update(&s_sched, t_ms, temperature_centi, pressure_q8);
+        const sampling_scheduler_metrics_t *m = sampling_scheduler_get_metrics(&s_sched);
+
+        if (m->last_decision == SAMPLING_DECISION_FAST) {
+            fast_samples++;
+            TEST_ASSERT_EQUAL_UINT32(SAMPLING_MIN_INTERVAL_MS, interval);
+
+            // Vor dem offenen Fenster darf nichts auslösen
+            TEST_ASSERT_TRUE(t_ms > 3600000u);
+            if (!window_detect_ms) {
+                window_detect_ms = t_ms;
+            } else if (!front_detect_ms && t_ms > 10800000u) {
+                front_detect_ms = t_ms;
+            }
+        }
+
+        // Zwischen Fenster und Front muss der Scheduler wieder zurückfallen
+        if (t_ms > 9000000u && t_ms < 10800000u) {
+            TEST_ASSERT_EQUAL_UINT32(SAMPLING_MAX_INTERVAL_MS, interval);
+        }
+        t_ms += interval;
+    }
+
+    const sampling_scheduler_metrics_t *m = sampling_scheduler_get_metrics(&s_sched);
+
+    // Fenster: Reaktion mit der ersten Messung nach Beginn (max. ein 5min Intervall)
+    TEST_ASSERT_TRUE(window_detect_ms > 0);
+    TEST_ASSERT_TRUE(window_detect_ms - 3600000u <= SAMPLING_MAX_INTERVAL_MS);
+
+    // Front: -250 Pa/h überschreitet 100 Pa/h innerhalb von 30min
+    TEST_ASSERT_TRUE(front_detect_ms > 0);
+    TEST_ASSERT_TRUE(front_detect_ms - 10800000u <= 1800000u);
+
+    TEST_ASSERT_EQUAL_UINT32(2, m->fast_triggers);
+    TEST_ASSERT_TRUE(fast_samples > 0);
+}
+
+void test_hysteresis_holds_interval(void)
+{
+    // 1h mit 300 Pa/h (schnell), danach 75 Pa/h zwischen unterer und oberer Schwelle
+    uint32_t t_ms = 0;
+
+    while (t_ms < 3 * 3600000u) {
+        double hours = t_ms / 3600000.0;
+        double pressure = hours < 1.0 ? 101325.0 - 300.0 * hours
+                                      : 101025.0 - 75.0 * (hours - 1.0);
+        uint32_t interval = sampling_scheduler_update(&s_sched, t_ms, 2100, (uint32_t)(pressure * 256.0 + 0.5));
+        const sampling_scheduler_metrics_t *m = sampling_scheduler_get_metrics(&s_sched);
+
+        if (t_ms >= 3600000u && t_ms < 3 * 3600000u) {
+            // Im Hysterese-Band: kürzestes Intervall wird gehalten, keine Verlängerung
+            TEST_ASSERT_EQUAL_UINT32(SAMPLING_MIN_INTERVAL_MS, interval);
+            TEST_ASSERT_TRUE(m->last_decision != SAMPLING_DECISION_BACKOFF);
+        }
+        t_ms += interval;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(1, sampling_scheduler_get_metrics(&s_sched)->fast_triggers);
+}
+
+/**
+ * @brief Spielt eine rauschfreie Luftdruck-Rampe mit festem 2s Takt ab
+ *
+ * Nach 1h Einschwingen (6 Zeitkonstanten) wird die geschätzte Rate geprüft
+ * und die Entscheidungen der zweiten Stunde gezählt.
+ */
+static void ramp_run(float rate_pa_h, uint32_t *fast, uint32_t *backoff)
+{
+    *fast = 0;
+    *backoff = 0;
+    for (uint32_t t_ms = 0; t_ms <= 2 * 3600000u; t_ms += SAMPLING_MIN_INTERVAL_MS) {
+        double pressure = 101325.0 - rate_pa_h * t_ms / 3600000.0;
+        sampling_scheduler_update(&s_sched, t_ms, 2100, (uint32_t)(pressure * 256.0 + 0.5));
+        const sampling_scheduler_metrics_t *m = sampling_scheduler_get_metrics(&s_sched);
+
+        if (t_ms >= 3600000u) {
+            TEST_ASSERT_INT_WITHIN(30, (int32_t)(-rate_pa_h * 100.0f), m->press_rate);
+            *fast += m->last_decision == SAMPLING_DECISION_FAST;
+            *backoff += m->last_decision == SAMPLING_DECISION_BACKOFF;
+        }
+    }
+}
+
+void test_ramp_rate_resolution(void)
+{
+    // Kleine Änderungen bei kurzem Intervall dürfen nicht verloren gehen
+    static const float rates[] = { 10.0f, 47.0f, 52.0f, 95.0f, 98.0f };
+    uint32_t fast, backoff;
+
+    for (size_t i = 0; i < sizeof(rates) / sizeof(rates[0]); i++) {
+        setUp();
+        ramp_run(rates[i], &fast, &backoff);
+    }
+}
+
+void test_ramp_in_band_holds(void)
+{
+    // 55 Pa/h liegt zwischen den Schwellen: keine Verlängerung
+    uint32_t fast, backoff;
+    ramp_run(55.0f, &fast, &backoff);
+    TEST_ASSERT_EQUAL_UINT32(0, backoff);
+    TEST_ASSERT_EQUAL_UINT32(0, fast);
+}
+
+void test_ramp_above_threshold_is_fast(void)
+{
+    // 105 Pa/h liegt über der oberen Schwelle: jede Messung schnell
+    uint32_t fast, backoff;
+    ramp_run(105.0f, &fast, &backoff);
+    TEST_ASSERT_EQUAL_UINT32(1801, fast);
+    TEST_ASSERT_EQUAL_UINT32(0, backoff);
+    TEST_ASSERT_EQUAL_UINT32(SAMPLING_MIN_INTERVAL_MS, sampling_scheduler_get_interval(&s_sched));
+}
+
+void test_timestamp_wraparound(void)
+{
+    // Zeitstempel nahe 2^32 ms: Überlauf darf keine Änderungsrate erzeugen
+    uint32_t t_ms = UINT32_MAX - 30000u;
+
+    for (int i = 0; i < 20; i++) {
+        uint32_t interval = sampling_scheduler_update(&s_sched, t_ms, 2100, 101325u * 256u);
+        TEST_ASSERT_TRUE(sampling_scheduler_get_metrics(&s_sched)->last_decision != SAMPLING_DECISION_FAST);
+        t_ms += interval;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, sampling_scheduler_get_metrics(&s_sched)->fast_triggers);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_rejects_invalid_config);
+    RUN_TEST(test_calm_backs_off_to_max);
+    RUN_TEST(test_trace_window_and_front);
+    RUN_TEST(test_hysteresis_holds_interval);
+    RUN_TEST(test_ramp_rate_resolution);
+    RUN_TEST(test_ramp_in_band_holds);
+    RUN_TEST(test_ramp_above_threshold_is_fast);
+    RUN_TEST(test_timestamp_wraparound);
+    return UNITY_END();
+}